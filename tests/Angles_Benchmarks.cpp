@@ -0,0 +1,172 @@
+#include "catch2/catch_amalgamated.hpp"
+
+#define COMPILE_ANGLES_BENCHMARKS 0
+
+#if COMPILE_ANGLES_BENCHMARKS
+    #include "mlm/angles/DegreesRadians.h"
+    #include "mlm_BenchmarksCommon.h"
+
+TEMPLATE_TEST_CASE("MLM.Angles.Benchmark conversions", "[Angles][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto values = RandomScalarArray(count, rng);
+    const auto degs = RandomDegreesArray(count, rng);
+    const auto rads = mlm_bench::makeArray<Rads<TestType>>(
+        count, rng, [](auto& r) { return Rads<TestType>(TestDegrees(r())); });
+    std::vector<TestType> scalars(count);
+    std::vector<Rads<TestType>> outRads(rads);
+    std::vector<TestDegrees> outDegs(degs);
+
+    BENCHMARK(mlm_bench::name("radToDeg", count))
+    {
+        return mlm_bench::mapIndices(scalars,
+                                     [&](std::size_t i) { return mlm::radToDeg(values[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("degToRad", count))
+    {
+        return mlm_bench::mapIndices(scalars,
+                                     [&](std::size_t i) { return mlm::degToRad(values[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Degs to Rads", count))
+    {
+        return mlm_bench::mapIndices(outRads,
+                                     [&](std::size_t i) { return Rads<TestType>(degs[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rads to Degs", count))
+    {
+        return mlm_bench::mapIndices(outDegs, [&](std::size_t i) { return TestDegrees(rads[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rads value", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return rads[i](); });
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Angles.Benchmark operators", "[Angles][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto values = RandomScalarArray(count, rng);
+    const auto degs = RandomDegreesArray(count, rng);
+    const auto others = RandomDegreesArray(count, rng);
+    std::vector<TestDegrees> out(degs);
+
+    BENCHMARK(mlm_bench::name("Mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return degs[i] * values[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestDegrees d = degs[i];
+            d *= values[i];
+            return d;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return degs[i] + values[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestDegrees d = degs[i];
+            d += values[i];
+            return d;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Negate", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return -degs[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Equality", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += (degs[i] == others[i]);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Angles.Benchmark Rads operators", "[Angles][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto values = RandomScalarArray(count, rng);
+    const auto rads = mlm_bench::makeArray<Rads<TestType>>(
+        count, rng, [](auto& r) { return Rads<TestType>(TestDegrees(r())); });
+    const auto others = mlm_bench::makeArray<Rads<TestType>>(
+        count, rng, [](auto& r) { return Rads<TestType>(TestDegrees(r())); });
+    std::vector<Rads<TestType>> out(rads);
+
+    BENCHMARK(mlm_bench::name("Mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return rads[i] * values[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            Rads<TestType> r = rads[i];
+            r *= values[i];
+            return r;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return rads[i] + values[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            Rads<TestType> r = rads[i];
+            r += values[i];
+            return r;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Negate", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return -rads[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Equality", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += (rads[i] == others[i]);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Angles.Benchmark trigonometry", "[Angles][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto rads = mlm_bench::makeArray<Rads<TestType>>(
+        count, rng, [](auto& r) { return Rads<TestType>(TestDegrees(r())); });
+    std::vector<Rads<TestType>> out(rads);
+
+    BENCHMARK(mlm_bench::name("Cos", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return mlm::cos(rads[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Sin", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return mlm::sin(rads[i]); });
+    };
+}
+#endif // #if COMPILE_ANGLES_BENCHMARKS
@@ -0,0 +1,71 @@
+#include "catch2/catch_amalgamated.hpp"
+
+#define COMPILE_EQUALITY_BENCHMARKS 0
+
+#if COMPILE_EQUALITY_BENCHMARKS
+    #include "mlm/functions/Equality.h"
+    #include "mlm_BenchmarksCommon.h"
+    #include <iterator>
+    #include <limits>
+
+TEMPLATE_TEST_CASE("MLM.Equality.Benchmark almostEquals", "[almostEquals][benchmark]", int, float,
+                   double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomScalarArray(count, rng);
+    const auto b = RandomScalarArray(count, rng);
+
+    BENCHMARK(mlm_bench::name("Same values", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += almostEquals<TestType>(a[i], a[i]);
+        return equal;
+    };
+
+    BENCHMARK(mlm_bench::name("Different values", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += almostEquals<TestType>(a[i], b[i]);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Equality.Benchmark almostEquals edge cases", "[almostEquals][benchmark]",
+                   float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomScalarArray(count, rng);
+
+    // Cycles through the special values handled by almostEquals (see Equality_Tests.cpp)
+    const TestType specials[] = {(TestType)0,
+                                 -(TestType)0,
+                                 std::numeric_limits<TestType>::denorm_min(),
+                                 std::numeric_limits<TestType>::min(),
+                                 std::numeric_limits<TestType>::max(),
+                                 std::numeric_limits<TestType>::infinity(),
+                                 -std::numeric_limits<TestType>::infinity(),
+                                 std::numeric_limits<TestType>::quiet_NaN()};
+    const std::size_t specialsCount = std::size(specials);
+
+    BENCHMARK(mlm_bench::name("Special values", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += almostEquals<TestType>(a[i], specials[i % specialsCount]);
+        return equal;
+    };
+
+    BENCHMARK(mlm_bench::name("Around zero", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += almostEquals<TestType>(a[i] * std::numeric_limits<TestType>::epsilon(),
+                                            -a[i] * std::numeric_limits<TestType>::epsilon());
+        return equal;
+    };
+}
+#endif // COMPILE_EQUALITY_BENCHMARKS
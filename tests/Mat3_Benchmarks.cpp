@@ -0,0 +1,149 @@
+#include "catch2/catch_amalgamated.hpp"
+
+#define COMPILE_MAT3_BENCHMARKS 0
+
+#if COMPILE_MAT3_BENCHMARKS
+    #include "mlm/matrix/Mat3.h"
+    #include "mlm_BenchmarksCommon.h"
+
+TEMPLATE_TEST_CASE("MLM.Mat3.Benchmark operators", "[Mat3][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomMat3Array(count, rng);
+    const auto b = RandomMat3Array(count, rng);
+    const auto points = RandomVec3Array(count, rng);
+    const auto s = RandomScalarArray(count, rng);
+    std::vector<TestMat3> out(count);
+    std::vector<TestVec3> outPoints(count);
+
+    BENCHMARK(mlm_bench::name("Mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] * b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestMat3 m = a[i];
+            m *= b[i];
+            return m;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound div scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestMat3 m = a[i];
+            m /= s[i];
+            return m;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Mul Vec3", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) { return a[i] * points[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Element access", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) {
+            return TestVec3(a[i](0, 0), a[i](1, 1), a[i](2, 2));
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Column access", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) { return a[i][2]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Transpose", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].transpose(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Inverse", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].inverse(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Equals with margin", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += a[i].equalsWithMargin(b[i], (TestType)1e-6);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Mat3.Benchmark factories", "[Mat3][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto angles = RandomDegreesArray(count, rng);
+    const auto axes = RandomVec3Array(count, rng);
+    std::vector<TestMat3> out(count);
+
+    BENCHMARK(mlm_bench::name("Identity", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t) { return TestMat3::identity(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Scale", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return TestMat3::scale(axes[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation around X", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat3::rotationAroundX(angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation around Y", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat3::rotationAroundY(angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation around Z", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat3::rotationAroundZ(angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat3::rotation(axes[i], angles[i]); });
+    };
+}
+
+    // Set to 1 to compile Euler angles conversion methods benchmarks
+    #define COMPILE_MAT3_EULER_ANGLES_BENCHMARKS 0
+    #if COMPILE_MAT3_EULER_ANGLES_BENCHMARKS
+TEMPLATE_TEST_CASE("MLM.Mat3.Benchmark Euler angles", "[Mat3][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto eulers = RandomEulerAnglesArray(count, rng);
+    const auto rotations = mlm_bench::makeArray<TestMat3>(count, rng, [](auto& r) {
+        return TestMat3::fromEulerAngles(TestEulerAngles(r(), r(), r()));
+    });
+    std::vector<TestMat3> out(count);
+    std::vector<TestEulerAnglesType> outEulers(eulers);
+
+    BENCHMARK(mlm_bench::name("From Euler angles", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat3::fromEulerAngles(eulers[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("To Euler angles", count))
+    {
+        return mlm_bench::mapIndices(outEulers,
+                                     [&](std::size_t i) { return rotations[i].toEulerAngles(); });
+    };
+}
+    #endif // COMPILE_MAT3_EULER_ANGLES_BENCHMARKS
+#endif     // COMPILE_MAT3_BENCHMARKS
@@ -0,0 +1,145 @@
+#include "catch2/catch_amalgamated.hpp"
+
+#define COMPILE_MAT4_BENCHMARKS 0
+
+#if COMPILE_MAT4_BENCHMARKS
+    #include "mlm/matrix/Mat4.h"
+    #include "mlm_BenchmarksCommon.h"
+
+TEMPLATE_TEST_CASE("MLM.Mat4.Benchmark operators", "[Mat4][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomMat4Array(count, rng);
+    const auto b = RandomMat4Array(count, rng);
+    const auto points = RandomVec4Array(count, rng);
+    const auto s = RandomScalarArray(count, rng);
+    std::vector<TestMat4> out(count);
+    std::vector<TestVec4> outPoints(count);
+    std::vector<TestMat3> outMat3(count);
+
+    BENCHMARK(mlm_bench::name("Mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] * b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestMat4 m = a[i];
+            m *= b[i];
+            return m;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound div scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestMat4 m = a[i];
+            m /= s[i];
+            return m;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Mul Vec4", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) { return a[i] * points[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Element access", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) {
+            return TestVec4(a[i](0, 0), a[i](1, 1), a[i](2, 2), a[i](3, 3));
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Column access", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) { return a[i][3]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Get column", count))
+    {
+        return mlm_bench::mapIndices(outPoints, [&](std::size_t i) { return a[i].getColumn(3); });
+    };
+
+    BENCHMARK(mlm_bench::name("To Mat3", count))
+    {
+        return mlm_bench::mapIndices(outMat3, [&](std::size_t i) { return a[i].toMat3(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Transpose", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].transpose(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Inverse", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].inverse(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Equality", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += (a[i] == b[i]);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Mat4.Benchmark factories", "[Mat4][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto angles = RandomDegreesArray(count, rng);
+    const auto axes = RandomVec3Array(count, rng);
+    std::vector<TestMat4> out(count);
+
+    BENCHMARK(mlm_bench::name("Identity", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t) { return TestMat4::identity(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Scale", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return TestMat4::scale(axes[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Translation", count))
+    {
+        return mlm_bench::mapIndices(out,
+                                     [&](std::size_t i) { return TestMat4::translation(axes[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation around X", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat4::rotationAroundX(angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation around Y", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat4::rotationAroundY(angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation around Z", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat4::rotationAroundZ(angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Rotation", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestMat4::rotation(axes[i], angles[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Scale * translation", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            return TestMat4::scale(axes[i]) * TestMat4::translation(axes[i]);
+        });
+    };
+}
+#endif // COMPILE_MAT4_BENCHMARKS
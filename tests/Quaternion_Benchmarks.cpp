@@ -0,0 +1,281 @@
+#include "catch2/catch_amalgamated.hpp"
+
+#define COMPILE_QUATERNION_BENCHMARKS 0
+
+#if COMPILE_QUATERNION_BENCHMARKS
+    #include "mlm/quaternion/Quaternion.h"
+    #include "mlm_BenchmarksCommon.h"
+
+TEMPLATE_TEST_CASE("MLM.Quaternion.Benchmark operators", "[Quaternion][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomUnitQuatArray(count, rng);
+    const auto b = RandomUnitQuatArray(count, rng);
+    const auto s = RandomScalarArray(count, rng);
+    std::vector<TestQuat> nonUnit(count);
+    mlm_bench::mapIndices(nonUnit, [&](std::size_t i) { return a[i] * s[i]; });
+    std::vector<TestQuat> out(count);
+    std::vector<TestType> scalars(count);
+
+    BENCHMARK(mlm_bench::name("Add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] + b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Sub", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] - b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Negate", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return -a[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestQuat q = a[i];
+            q += b[i];
+            return q;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound sub", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestQuat q = a[i];
+            q -= b[i];
+            return q;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Mul scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] * s[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound div scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestQuat q = a[i];
+            q /= s[i];
+            return q;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] * b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestQuat q = a[i];
+            q *= b[i];
+            return q;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Element access", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestQuat(a[i][3], a[i][2], a[i][1], a[i][0]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Dot", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].dot(b[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Magnitude", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].magnitude(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Norm", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].norm(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Modulus", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].modulus(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Square magnitude", count))
+    {
+        return mlm_bench::mapIndices(scalars,
+                                     [&](std::size_t i) { return a[i].squareMagnitude(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Is unit", count))
+    {
+        std::size_t units = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            units += a[i].isUnit();
+        return units;
+    };
+
+    BENCHMARK(mlm_bench::name("Is zero", count))
+    {
+        std::size_t zeros = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            zeros += a[i].isZero();
+        return zeros;
+    };
+
+    BENCHMARK(mlm_bench::name("Is pure", count))
+    {
+        std::size_t matches = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            matches += a[i].isPure();
+        return matches;
+    };
+
+    BENCHMARK(mlm_bench::name("Is real", count))
+    {
+        std::size_t matches = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            matches += a[i].isReal();
+        return matches;
+    };
+
+    BENCHMARK(mlm_bench::name("Normalize", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return nonUnit[i].normalize(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Conjugate", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].conjugate(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Inverse", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].inverse(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Inverse unit", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].inverseUnit(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Equality", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += (a[i] == b[i]);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Quaternion.Benchmark rotations", "[Quaternion][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto q = RandomUnitQuatArray(count, rng);
+    const auto points = RandomVec3Array(count, rng);
+    const auto s = RandomScalarArray(count, rng);
+    std::vector<TestQuat> out(count);
+    std::vector<TestVec3> outPoints(count);
+
+    BENCHMARK(mlm_bench::name("Rotate", count))
+    {
+        return mlm_bench::mapIndices(outPoints,
+                                     [&](std::size_t i) { return q[i].rotate(points[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Log", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return q[i].log(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Exp", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return q[i].exp(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Pow", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return q[i].pow(s[i] / 100); });
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Quaternion.Benchmark conversions", "[Quaternion][benchmark]", float,
+                   double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto q = RandomUnitQuatArray(count, rng);
+    const auto angles = RandomDegreesArray(count, rng);
+    const auto axes = RandomVec3Array(count, rng);
+    const auto eulers = RandomEulerAnglesArray(count, rng);
+    const auto matrices = mlm_bench::makeArray<TestMat3>(count, rng, [](auto& r) {
+        return TestMat3::rotation(TestVec3(r(), r(), r()), TestDegrees(r()));
+    });
+    std::vector<TestQuat> out(count);
+    std::vector<TestMat3> outMatrices(count);
+    std::vector<AngleAxis<TestType>> outAngleAxes(count, q[0].toAngleAxis());
+    std::vector<TestEulerAnglesType> outEulers(eulers);
+
+    BENCHMARK(mlm_bench::name("To matrix", count))
+    {
+        return mlm_bench::mapIndices(outMatrices, [&](std::size_t i) { return q[i].toMatrix(); });
+    };
+
+    BENCHMARK(mlm_bench::name("From matrix", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestQuat::fromMatrix(matrices[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("To angle-axis", count))
+    {
+        return mlm_bench::mapIndices(outAngleAxes,
+                                     [&](std::size_t i) { return q[i].toAngleAxis(); });
+    };
+
+    BENCHMARK(mlm_bench::name("From angle-axis", count))
+    {
+        return mlm_bench::mapIndices(
+            out, [&](std::size_t i) { return TestQuat::fromAngleAxis(angles[i], axes[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("From Euler angles", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return TestQuat(eulers[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("To Euler angles", count))
+    {
+        return mlm_bench::mapIndices(outEulers,
+                                     [&](std::size_t i) { return q[i].toEulerAngles(); });
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Quaternion.Benchmark parsing", "[Quaternion][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto strings = mlm_bench::makeStrings(count, rng, 4);
+    std::vector<TestQuat> out(count);
+
+    BENCHMARK(mlm_bench::name("Construct from string", count))
+    {
+        return mlm_bench::mapIndices(out,
+                                     [&](std::size_t i) { return TestQuat(strings[i].c_str()); });
+    };
+
+    BENCHMARK(mlm_bench::name("Assign from string", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestQuat q;
+            q = strings[i];
+            return q;
+        });
+    };
+}
+#endif // COMPILE_QUATERNION_BENCHMARKS
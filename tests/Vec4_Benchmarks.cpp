@@ -0,0 +1,238 @@
+#include "catch2/catch_amalgamated.hpp"
+
+#define COMPILE_VEC4_BENCHMARKS 0
+
+#if COMPILE_VEC4_BENCHMARKS
+    #include "mlm/vector/Vec4.h"
+    #include "mlm_BenchmarksCommon.h"
+
+TEMPLATE_TEST_CASE("MLM.Vec4.Benchmark operators", "[Vec4][benchmark]", int, float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomVec4Array(count, rng);
+    const auto b = RandomVec4Array(count, rng);
+    const auto s = RandomScalarArray(count, rng);
+    std::vector<TestVec4> out(count);
+
+    BENCHMARK(mlm_bench::name("Add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] + b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Sub", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] - b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Mul scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] * s[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] * b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Div scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] / s[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Div", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i] / b[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound add", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v += b[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound sub", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v -= b[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v *= b[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound div", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v /= b[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound add scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v += s[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound sub scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v -= s[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound mul scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v *= s[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Compound div scalar", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v = a[i];
+            v /= s[i];
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Element access", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            return TestVec4(a[i][3], a[i][2], a[i][1], a[i][0]);
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("Equality", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += (a[i] == b[i]);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Vec4.Benchmark products and norms", "[Vec4][benchmark]", float, double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto a = RandomVec4Array(count, rng);
+    const auto b = RandomVec4Array(count, rng);
+    std::vector<TestVec4> out(count);
+    std::vector<TestType> scalars(count);
+
+    BENCHMARK(mlm_bench::name("Dot", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].dot(b[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Cross", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].cross(b[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Norm", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].norm(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Magnitude", count))
+    {
+        return mlm_bench::mapIndices(scalars, [&](std::size_t i) { return a[i].magnitude(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Square magnitude", count))
+    {
+        return mlm_bench::mapIndices(scalars,
+                                     [&](std::size_t i) { return a[i].squareMagnitude(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Normalize", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].normalize(); });
+    };
+
+    BENCHMARK(mlm_bench::name("Project", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].project(b[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Reject", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].reject(b[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Reflect", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) { return a[i].reflect(b[i]); });
+    };
+
+    BENCHMARK(mlm_bench::name("Equals with margin", count))
+    {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            equal += a[i].equalsWithMargin(b[i], (TestType)1e-6);
+        return equal;
+    };
+}
+
+TEMPLATE_TEST_CASE("MLM.Vec4.Benchmark parsing and formatting", "[Vec4][benchmark]", int, float,
+                   double)
+{
+    const std::size_t count = BenchmarkArraySize;
+    mlm_bench::RandomScalars<TestType> rng;
+    const auto strings = mlm_bench::makeStrings(count, rng, 4);
+    const auto a = RandomVec4Array(count, rng);
+    std::vector<TestVec4> out(count);
+    std::vector<std::string> outStrings(count);
+
+    BENCHMARK(mlm_bench::name("Construct from string", count))
+    {
+        return mlm_bench::mapIndices(out,
+                                     [&](std::size_t i) { return TestVec4(strings[i].c_str()); });
+    };
+
+    BENCHMARK(mlm_bench::name("Assign from string", count))
+    {
+        return mlm_bench::mapIndices(out, [&](std::size_t i) {
+            TestVec4 v;
+            v = strings[i].c_str();
+            return v;
+        });
+    };
+
+    BENCHMARK(mlm_bench::name("String concatenation", count))
+    {
+        return mlm_bench::mapIndices(outStrings, [&](std::size_t i) { return "Vec: " + a[i]; });
+    };
+
+    BENCHMARK(mlm_bench::name("Output stream", count))
+    {
+        std::ostringstream stream;
+        for (std::size_t i = 0; i < count; ++i)
+            stream << a[i];
+        return static_cast<std::size_t>(stream.tellp());
+    };
+}
+#endif // COMPILE_VEC4_BENCHMARKS
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "mlm_TestsCommon.h"
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Set to 1 to also run every benchmark on 100M-element arrays.
+// Be careful: each test case allocates all its input and output arrays at once. Every array size
+// is a separate run of the test case, so only the 100M arrays are alive at that point, but the
+// peak of a single test case at 100M elements is still huge:
+// - "Mat4.Benchmark operators": 7 arrays, ~264 bytes per element, so ~26GB float / ~53GB double;
+// - "Quaternion.Benchmark conversions": 9 arrays, ~160 bytes per element, so ~16GB / ~32GB;
+// - "Mat3.Benchmark operators": 6 arrays, ~136 bytes per element, so ~14GB / ~27GB;
+// - the parsing and formatting cases also keep 100M heap-allocated std::strings alive.
+// Filter the test cases to run (e.g. "[Vec3]") according to the memory of the machine.
+#ifndef MLM_BENCHMARK_HUGE_ARRAYS
+    #define MLM_BENCHMARK_HUGE_ARRAYS 0
+#endif
+
+namespace mlm_bench
+{
+/// @brief The array sizes every benchmark is run against.
+inline std::vector<std::size_t> arraySizes()
+{
+    return {
+        1'000, 1'000'000,
+#if MLM_BENCHMARK_HUGE_ARRAYS
+            100'000'000,
+#endif
+    };
+}
+
+/// @brief Builds a benchmark name carrying the number of elements processed per run.
+/// The " x<count>" suffix is parsed back by the throughput reporter to report ns/op.
+inline std::string name(const char* operation, std::size_t count)
+{
+    return std::string(operation) + " x" + std::to_string(count);
+}
+
+/// @brief Deterministic random scalar source. Values stay in [1, 100] so that
+/// divisions never hit zero and integer products do not overflow.
+template <typename T>
+class RandomScalars
+{
+public:
+    T operator()()
+    {
+        if constexpr (std::is_integral_v<T>)
+            return std::uniform_int_distribution<T>(1, 100)(m_engine);
+        else
+            return std::uniform_real_distribution<T>(1, 100)(m_engine);
+    }
+
+private:
+    std::mt19937 m_engine{42};
+};
+
+/// @brief Creates an array of count elements, each one built by make(rng).
+template <typename V, typename T, typename Make>
+std::vector<V> makeArray(std::size_t count, RandomScalars<T>& rng, Make&& make)
+{
+    std::vector<V> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        values.push_back(make(rng));
+    return values;
+}
+
+/// @brief Creates an array of count strings, each one made of components space-separated values,
+/// in the format expected by the string constructors of vectors and quaternions (e.g. "4 2 1").
+template <typename T>
+std::vector<std::string> makeStrings(std::size_t count, RandomScalars<T>& rng, int components)
+{
+    std::vector<std::string> strings;
+    strings.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::string str = std::to_string(rng());
+        for (int c = 1; c < components; ++c)
+            str += ' ' + std::to_string(rng());
+        strings.push_back(std::move(str));
+    }
+    return strings;
+}
+
+/// @brief Stores op(i) at every index of the output array.
+/// Returns the array data so the optimizer cannot discard the stores.
+template <typename Out, typename Op>
+Out* mapIndices(std::vector<Out>& out, Op&& op)
+{
+    for (std::size_t i = 0; i < out.size(); ++i)
+        out[i] = op(i);
+    return out.data();
+}
+} // namespace mlm_bench
+
+#define BenchmarkArraySize                                                                         \
+    GENERATE(Catch::Generators::from_range(mlm_bench::arraySizes()))
+
+#define RandomScalarArray(count, rng)                                                              \
+    mlm_bench::makeArray<TestType>(count, rng, [](auto& r) { return r(); })
+#define RandomVec2Array(count, rng)                                                                \
+    mlm_bench::makeArray<TestVec2>(count, rng, [](auto& r) { return TestVec2(r(), r()); })
+#define RandomVec3Array(count, rng)                                                                \
+    mlm_bench::makeArray<TestVec3>(count, rng, [](auto& r) { return TestVec3(r(), r(), r()); })
+#define RandomVec4Array(count, rng)                                                                \
+    mlm_bench::makeArray<TestVec4>(count, rng,                                                     \
+                                   [](auto& r) { return TestVec4(r(), r(), r(), r()); })
+#define RandomMat3Array(count, rng)                                                                \
+    mlm_bench::makeArray<TestMat3>(count, rng, [](auto& r) {                                       \
+        return TestMat3(r(), r(), r(), r(), r(), r(), r(), r(), r());                              \
+    })
+#define RandomMat4Array(count, rng)                                                                \
+    mlm_bench::makeArray<TestMat4>(count, rng, [](auto& r) {                                       \
+        return TestMat4(r(), r(), r(), r(), r(), r(), r(), r(), r(), r(), r(), r(), r(), r(), r(), \
+                        r());                                                                      \
+    })
+#define RandomDegreesArray(count, rng)                                                             \
+    mlm_bench::makeArray<TestDegrees>(count, rng, [](auto& r) { return TestDegrees(r()); })
+#define RandomEulerAnglesArray(count, rng)                                                         \
+    mlm_bench::makeArray<TestEulerAnglesType>(count, rng, [](auto& r) {                            \
+        return TestEulerAngles(r(), r(), r());                                                     \
+    })
+#define RandomUnitQuatArray(count, rng)                                                            \
+    mlm_bench::makeArray<TestQuat>(count, rng,                                                     \
+                                   [](auto& r) { return TestQuat(r(), r(), r(), r()).normalize(); })
@@ -0,0 +1,150 @@
+#include "catch2/catch_amalgamated.hpp"
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// @brief Console reporter that also reports ns/op and throughput of our benchmarks.
+/// Catch2 only reports the time of a whole benchmark run. Since our benchmarks process a whole
+/// array per run, the " x<count>" suffix of the benchmark name (see mlm_bench::name) is used to
+/// compute the per-element figures, which are printed once each test case run ends.
+/// Catch2's ConsoleReporter is final, so it is wrapped and every event is forwarded to it;
+/// both write to the same stream, so the output honors the reporter's "::out=<file>" option.
+/// This is the default reporter of MLM_Benchmarks (see CATCH_CONFIG_DEFAULT_REPORTER).
+class ThroughputReporter : public Catch::IEventListener
+{
+public:
+    ThroughputReporter(Catch::ReporterConfig&& config) : Catch::IEventListener(config.fullConfig())
+    {
+        Catch::IConfig const* fullConfig = config.fullConfig();
+        const Catch::ColourMode colourMode = config.colourMode();
+        auto customOptions = config.customOptions();
+        auto stream = std::move(config).takeStream();
+        m_stream = &stream->stream();
+
+        m_console = Catch::Detail::make_unique<Catch::ConsoleReporter>(Catch::ReporterConfig(
+            fullConfig, std::move(stream), colourMode, std::move(customOptions)));
+        m_preferences = m_console->getPreferences();
+    }
+
+    static std::string getDescription()
+    {
+        return "Console reporter that also reports ns/op and throughput of array benchmarks";
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+    {
+        m_console->benchmarkEnded(stats);
+
+        const std::string& name = stats.info.name;
+        const std::size_t suffixPos = name.rfind(" x");
+        if (suffixPos == std::string::npos)
+            return;
+
+        const std::string countStr = name.substr(suffixPos + 2);
+        if (countStr.empty() || countStr.find_first_not_of("0123456789") != std::string::npos)
+            return;
+
+        const double count = std::stod(countStr);
+        const double nsPerRun = stats.mean.point.count();
+        if (count <= 0 || nsPerRun <= 0)
+            return;
+
+        m_results.push_back({name, nsPerRun / count});
+    }
+
+    void testCasePartialEnded(Catch::TestCaseStats const& stats, uint64_t partNumber) override
+    {
+        if (!m_results.empty())
+        {
+            std::ostream& out = *m_stream;
+            out << "\nbenchmark name                       ns/op         Mop/s\n";
+            for (const Result& result : m_results)
+            {
+                out << std::left << std::setw(37) << result.name << std::setw(14)
+                    << result.nsPerOp << 1000 / result.nsPerOp << '\n';
+            }
+            out << std::endl;
+            m_results.clear();
+        }
+
+        m_console->testCasePartialEnded(stats, partNumber);
+    }
+
+    // Everything else is forwarded untouched to the console reporter.
+    void noMatchingTestCases(Catch::StringRef spec) override
+    {
+        m_console->noMatchingTestCases(spec);
+    }
+    void reportInvalidTestSpec(Catch::StringRef arg) override
+    {
+        m_console->reportInvalidTestSpec(arg);
+    }
+    void testRunStarting(Catch::TestRunInfo const& info) override
+    {
+        m_console->testRunStarting(info);
+    }
+    void testCaseStarting(Catch::TestCaseInfo const& info) override
+    {
+        m_console->testCaseStarting(info);
+    }
+    void testCasePartialStarting(Catch::TestCaseInfo const& info, uint64_t partNumber) override
+    {
+        m_console->testCasePartialStarting(info, partNumber);
+    }
+    void sectionStarting(Catch::SectionInfo const& info) override
+    {
+        m_console->sectionStarting(info);
+    }
+    void benchmarkPreparing(Catch::StringRef name) override { m_console->benchmarkPreparing(name); }
+    void benchmarkStarting(Catch::BenchmarkInfo const& info) override
+    {
+        m_console->benchmarkStarting(info);
+    }
+    void benchmarkFailed(Catch::StringRef error) override { m_console->benchmarkFailed(error); }
+    void assertionStarting(Catch::AssertionInfo const& info) override
+    {
+        m_console->assertionStarting(info);
+    }
+    void assertionEnded(Catch::AssertionStats const& stats) override
+    {
+        m_console->assertionEnded(stats);
+    }
+    void sectionEnded(Catch::SectionStats const& stats) override { m_console->sectionEnded(stats); }
+    void testCaseEnded(Catch::TestCaseStats const& stats) override
+    {
+        m_console->testCaseEnded(stats);
+    }
+    void testRunEnded(Catch::TestRunStats const& stats) override { m_console->testRunEnded(stats); }
+    void skipTest(Catch::TestCaseInfo const& info) override { m_console->skipTest(info); }
+    void fatalErrorEncountered(Catch::StringRef error) override
+    {
+        m_console->fatalErrorEncountered(error);
+    }
+    void listReporters(std::vector<Catch::ReporterDescription> const& descriptions) override
+    {
+        m_console->listReporters(descriptions);
+    }
+    void listListeners(std::vector<Catch::ListenerDescription> const& descriptions) override
+    {
+        m_console->listListeners(descriptions);
+    }
+    void listTests(std::vector<Catch::TestCaseHandle> const& tests) override
+    {
+        m_console->listTests(tests);
+    }
+    void listTags(std::vector<Catch::TagInfo> const& tags) override { m_console->listTags(tags); }
+
+private:
+    struct Result
+    {
+        std::string name;
+        double nsPerOp;
+    };
+
+    Catch::Detail::unique_ptr<Catch::ConsoleReporter> m_console;
+    std::ostream* m_stream = nullptr;
+    std::vector<Result> m_results;
+};
+
+CATCH_REGISTER_REPORTER("throughput", ThroughputReporter)